@@ -63,6 +63,106 @@ auto register_tests()
         require_eq("sure."s, cryptic::base64::decode("c3VyZS4="));
     };
 
+    test_case("CrypticBase64::Sizes, [cryptic]") = [] {
+        using cryptic::base64::padding;
+        require_eq(0ul, cryptic::base64::encoded_size(0));
+        require_eq(4ul, cryptic::base64::encoded_size(1));
+        require_eq(4ul, cryptic::base64::encoded_size(3));
+        require_eq(8ul, cryptic::base64::encoded_size(4));
+        require_eq(2ul, cryptic::base64::encoded_size(1, padding::no));
+        require_eq(3ul, cryptic::base64::encoded_size(2, padding::no));
+        require_eq(4ul, cryptic::base64::encoded_size(3, padding::no));
+
+        require_eq(0ul, cryptic::base64::decoded_size(""));
+        require_eq(1ul, cryptic::base64::decoded_size("TQ=="));
+        require_eq(2ul, cryptic::base64::decoded_size("TWE="));
+        require_eq(3ul, cryptic::base64::decoded_size("TWFu"));
+        require_eq(1ul, cryptic::base64::decoded_size("TQ"));
+        require_eq(2ul, cryptic::base64::decoded_size("TWE"));
+    };
+
+    test_case("CrypticBase64::Variants, [cryptic]") = [] {
+        using cryptic::base64::alphabet;
+        using cryptic::base64::padding;
+        const auto bytes = "\xfb\xff\xbf"s;
+        require_eq("+/+/"s, cryptic::base64::encode(bytes));
+        require_eq("-_-_"s, cryptic::base64::encode(bytes, alphabet::url));
+        require_eq("TQ"s, cryptic::base64::encode("M"s, alphabet::standard, padding::no));
+        require_eq("TWE"s, cryptic::base64::encode("Ma"s, alphabet::url, padding::no));
+
+        require_eq(bytes, cryptic::base64::try_decode("+/+/").value());
+        require_eq(bytes, cryptic::base64::try_decode("-_-_", alphabet::url).value());
+        require_eq("M"s, cryptic::base64::try_decode("TQ").value());
+        require_eq("Ma"s, cryptic::base64::try_decode("TWE", alphabet::url).value());
+    };
+
+    test_case("CrypticBase64::Buffers, [cryptic]") = [] {
+        auto encoded = std::array<char, 12>{};
+        require_eq(12ul, cryptic::base64::encode("pleasure."s, std::span{encoded}));
+        require_eq("cGxlYXN1cmUu"s, std::string(encoded.begin(), encoded.end()));
+
+        auto decoded = std::array<std::byte, 9>{};
+        const auto size = cryptic::base64::decode("cGxlYXN1cmUu", std::span{decoded});
+        require_eq(9ul, size.value());
+        require_eq("pleasure."s, std::string(reinterpret_cast<const char*>(decoded.data()), decoded.size()));
+    };
+
+    test_case("CrypticBase64::InvalidInput, [cryptic]") = [] {
+        using cryptic::base64::alphabet;
+        require_eq(2ul, cryptic::base64::try_decode("TW*u").error().position);
+        require_eq(1ul, cryptic::base64::try_decode("T=Fu").error().position);
+        require_eq(4ul, cryptic::base64::try_decode("TWFuT").error().position);
+        require_eq(0ul, cryptic::base64::try_decode("-_-_").error().position);
+        require_eq(0ul, cryptic::base64::try_decode("+/+/", alphabet::url).error().position);
+        require_eq(3ul, cryptic::base64::try_decode("TWF\x80").error().position);
+
+        // Deep inside a long input, where the vector decoders run
+        auto encoded = cryptic::base64::encode(std::string(1'000, 'x'));
+        encoded[777] = '.';
+        require_eq(777ul, cryptic::base64::try_decode(encoded).error().position);
+    };
+
+    test_case("CrypticBase64::Backends, [cryptic]") = [] {
+        // Long inputs through AVX2, SSSE3 and the scalar code must agree with each other
+        auto message = std::string{};
+        for(auto i = 0uz; i < 1'000uz; ++i)
+            message.push_back(static_cast<char>(i * 131 + i / 7));
+
+        // Reference encodings from the scalar code
+        auto encodings = std::vector<std::string>{};
+        {
+            const auto scalar = cryptic::cpu::scoped_features{{}};
+            for(auto size = 0uz; size <= message.size(); size += 37uz)
+                encodings.push_back(cryptic::base64::encode(std::string_view{message}.substr(0, size)));
+        }
+
+        for(auto [avx2, ssse3] : {std::pair{true, true}, std::pair{false, true}, std::pair{false, false}})
+        {
+            auto subset = cryptic::cpu::features();
+            subset.avx2 = avx2;
+            subset.ssse3 = ssse3;
+            const auto backend = cryptic::cpu::scoped_features{subset};
+            for(auto size = 0uz; size <= message.size(); size += 37uz)
+            {
+                const auto prefix = std::string_view{message}.substr(0, size);
+                const auto& encoded = encodings[size / 37uz];
+                require_eq(encoded, cryptic::base64::encode(prefix));
+                require_eq(std::string{prefix}, cryptic::base64::try_decode(encoded).value());
+            }
+
+            // Invalid characters in and past the first 32-character AVX2 block and the 16-character SSSE3 ones
+            for(auto position : {0uz, 31uz, 32uz, 33uz, 47uz, 63uz, 64uz, 100uz, 777uz, 1'330uz})
+            {
+                for(auto c : {'.', '=', '\x80'})
+                {
+                    auto corrupt = encodings.back();
+                    corrupt[position] = c;
+                    require_eq(position, cryptic::base64::try_decode(corrupt).error().position);
+                }
+            }
+        }
+    };
+
     return 0;
 }
 
@@ -0,0 +1,46 @@
+// Copyright (c) 2025-2026 Kaius Ruokonen. All rights reserved.
+// SPDX-License-Identifier: MIT
+// See the LICENSE file in the project root for full license text.
+
+import std;
+import cryptic;
+import tester;
+
+namespace cryptic::cpu_test {
+
+auto register_tests()
+{
+    using tester::basic::test_case;
+    using namespace tester::assertions;
+
+    test_case("CrypticCPU::ScopedFeatures, [cryptic]") = [] {
+        const auto detected = cryptic::cpu::features();
+        require_eq(detected == cryptic::cpu::detect(), true);
+        {
+            // Flags can only be cleared, nested scopes narrow further and restore on exit
+            const auto outer = cryptic::cpu::scoped_features{{.ssse3 = true, .sha = false, .avx2 = true, .avx512 = true}};
+            require_eq(cryptic::cpu::features().sha, false);
+            require_eq(cryptic::cpu::features().ssse3, detected.ssse3);
+            require_eq(cryptic::cpu::features().avx2, detected.avx2);
+            {
+                const auto inner = cryptic::cpu::scoped_features{{.ssse3 = true, .sha = true, .avx2 = false, .avx512 = true}};
+                require_eq(cryptic::cpu::features().sha, false);
+                require_eq(cryptic::cpu::features().avx2, false);
+                require_eq(cryptic::cpu::features().avx512, detected.avx512);
+            }
+            require_eq(cryptic::cpu::features().avx2, detected.avx2);
+
+            // Other threads keep dispatching on everything the CPU has
+            auto other = cryptic::cpu::feature_set{};
+            std::thread{[&other] { other = cryptic::cpu::features(); }}.join();
+            require_eq(other == detected, true);
+        }
+        require_eq(cryptic::cpu::features() == detected, true);
+    };
+
+    return 0;
+}
+
+} // namespace cryptic::cpu_test
+
+const auto _ = cryptic::cpu_test::register_tests();
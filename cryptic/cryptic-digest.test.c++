@@ -0,0 +1,93 @@
+// Copyright (c) 2025-2026 Kaius Ruokonen. All rights reserved.
+// SPDX-License-Identifier: MIT
+// See the LICENSE file in the project root for full license text.
+
+import std;
+import cryptic;
+import tester;
+
+using namespace std::string_literals;
+using namespace std::string_view_literals;
+
+namespace cryptic::digest_test {
+
+constexpr auto view(const auto& characters)
+{
+    return std::string_view{characters.data(), characters.size()};
+}
+
+// Compile-time digests of literals
+static_assert(view(cryptic::sha1::digest("abc").to_hex()) == "a9993e364706816aba3e25717850c26c9cd0d89d"sv);
+static_assert(view(cryptic::sha256::digest("abc").to_hex()) == "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad"sv);
+static_assert(view(cryptic::sha512_256::digest("abc").to_hex()) == "53048e2681941ef99b2e29b76b4c7dabe4c2d0c634fc6d46e0e2f13107e7af23"sv);
+static_assert(view(cryptic::sha256::digest(""sv).to_base64()) == "47DEQpj8HBSa+/TImW+5JCeuQeRkm5NMpJWZG3hSuFU="sv);
+static_assert(cryptic::sha256::digest("abc") == cryptic::sha256::digest("abc"sv));
+static_assert(cryptic::sha256::digest("abc") != cryptic::sha256::digest("abd"));
+
+// Streaming across chunk boundaries at compile time
+constexpr auto streamed()
+{
+    auto hash = cryptic::sha224{};
+    hash.update("The quick brown fox jumps over the lazy dog. "sv);
+    hash.update("The quick brown fox jumps over the lazy dog."sv);
+    return cryptic::to_hex(hash.finalize());
+}
+static_assert(view(streamed()) == "d0c9fb8988c97350be3ebed30dff7c7bd6b96e3b20c81e87630024eb"sv);
+
+auto register_tests()
+{
+    using tester::basic::test_case;
+    using namespace tester::assertions;
+
+    test_case("CrypticDigest::Runtime, [cryptic]") = [] {
+        // The same results without constant evaluation
+        const auto message = "The quick brown fox jumps over the lazy dog"s;
+        const auto digest = cryptic::sha256::digest(message);
+
+        require_eq(std::string{view(digest.to_hex())}, cryptic::sha256::hexadecimal(message));
+        require_eq(std::string{view(digest.to_base64())}, cryptic::sha256::base64(message));
+        require_eq(std::string{view(cryptic::to_hex(cryptic::sha1::digest(message).bytes))}, cryptic::sha1::hexadecimal(message));
+        require_eq(std::string{view(digest.to_base64(cryptic::base64::alphabet::url))},
+                   cryptic::base64::encode(digest.bytes, cryptic::base64::alphabet::url));
+        require_eq(digest.size(), 32uz);
+    };
+
+    test_case("CrypticDigest::Ordering, [cryptic]") = [] {
+        auto digests = std::vector<cryptic::sha256::digest_type>{};
+        for(auto i = 0; i < 500; ++i)
+            digests.push_back(cryptic::sha256::digest(std::to_string(i)));
+
+        // <=> orders like the hexadecimal rendering
+        std::ranges::sort(digests);
+        for(auto i = 1uz; i < digests.size(); ++i)
+        {
+            require_eq(view(digests[i - 1].to_hex()) < view(digests[i].to_hex()), true);
+            require_eq(digests[i - 1] < digests[i], true);
+            require_eq(digests[i] <=> digests[i] == 0, true);
+        }
+    };
+
+    test_case("CrypticDigest::UnorderedMap, [cryptic]") = [] {
+        auto routes = std::unordered_map<cryptic::sha1::digest_type, int>{};
+        for(auto i = 0; i < 1000; ++i)
+            routes[cryptic::sha1::digest("/route/"s + std::to_string(i))] = i;
+
+        require_eq(routes.size(), 1000uz);
+        require_eq(routes.at(cryptic::sha1::digest("/route/42"s)), 42);
+        require_eq(routes.contains(cryptic::sha1::digest("/route/1000"s)), false);
+    };
+
+    test_case("CrypticDigest::Format, [cryptic]") = [] {
+        const auto digest = cryptic::sha1::digest("abc"s);
+        require_eq(std::format("{}", digest), "a9993e364706816aba3e25717850c26c9cd0d89d"s);
+        require_eq(std::format("{:x}", digest), "a9993e364706816aba3e25717850c26c9cd0d89d"s);
+        require_eq(std::format("{:X}", digest), "A9993E364706816ABA3E25717850C26C9CD0D89D"s);
+        require_eq(std::format("{:b}", digest), cryptic::sha1::base64("abc"s));
+    };
+
+    return 0;
+}
+
+} // namespace cryptic::digest_test
+
+const auto _ = cryptic::digest_test::register_tests();
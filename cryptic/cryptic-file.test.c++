@@ -0,0 +1,166 @@
+// Copyright (c) 2025-2026 Kaius Ruokonen. All rights reserved.
+// SPDX-License-Identifier: MIT
+// See the LICENSE file in the project root for full license text.
+
+import std;
+import cryptic;
+import tester;
+
+using namespace std::string_literals;
+
+namespace cryptic::file_test {
+
+// A fresh directory per test process under the system temp directory, so that concurrent
+// runs never overwrite or delete each other's files; removed with everything in it at exit
+struct scratch_directory
+{
+    scratch_directory()
+    {
+        auto random = std::random_device{};
+        do
+            path = std::filesystem::temp_directory_path() / ("cryptic-file-test-"s + std::to_string(random()) + "-"s + std::to_string(random()));
+        while (not std::filesystem::create_directory(path));
+    }
+
+    ~scratch_directory()
+    {
+        auto error = std::error_code{};
+        std::filesystem::remove_all(path, error);
+    }
+
+    std::filesystem::path path;
+};
+
+const std::filesystem::path& test_directory()
+{
+    static const auto scratch = scratch_directory{};
+    return scratch.path;
+}
+
+// Deterministic file content of the given size in the scratch directory
+std::filesystem::path make_file(const std::string& name, std::size_t size)
+{
+    const auto path = test_directory() / name;
+    auto content = std::string(size, '\0');
+    for(auto i = 0uz; i < size; ++i)
+        content[i] = static_cast<char>((i * 131u + i / 7u) bitand 0xFFu);
+    auto stream = std::ofstream{path, std::ios::binary | std::ios::trunc};
+    stream.write(content.data(), static_cast<std::streamsize>(content.size()));
+    return path;
+}
+
+std::string read_file(const std::filesystem::path& path)
+{
+    auto stream = std::ifstream{path, std::ios::binary};
+    return {std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+}
+
+auto register_tests()
+{
+    using tester::basic::test_case;
+    using namespace tester::assertions;
+
+    test_case("CrypticFile::Hash, [cryptic]") = [] {
+        // Empty, read through pread() and memory mapped
+        for(const auto size : {0uz, 1000uz, cryptic::file::mmap_threshold + 12345uz})
+        {
+            const auto path = make_file("hash-"s + std::to_string(size), size);
+            const auto digest = cryptic::file::hash<cryptic::sha256>(path);
+            require_eq(digest.has_value(), true);
+            require_eq(cryptic::base64::encode(*digest), cryptic::sha256::base64(read_file(path)));
+            std::filesystem::remove(path);
+        }
+    };
+
+    test_case("CrypticFile::Errors, [cryptic]") = [] {
+        const auto missing = cryptic::file::hash<cryptic::sha1>(test_directory() / "missing");
+        require_eq(missing.has_value(), false);
+        require_eq(missing.error() == std::errc::no_such_file_or_directory, true);
+
+        const auto directory = cryptic::file::hash<cryptic::sha1>(test_directory());
+        require_eq(directory.has_value(), false);
+        require_eq(directory.error() == std::errc::is_a_directory, true);
+    };
+
+    test_case("CrypticFile::ThreadPool, [cryptic]") = [] {
+        auto pool = cryptic::file::thread_pool{4};
+        require_eq(pool.size(), 4u);
+
+        for(auto round = 0; round < 100; ++round)
+        {
+            auto hits = std::vector<std::atomic<int>>(1000);
+            pool.for_each(hits.size(), [&](std::size_t i){ ++hits[i]; });
+            require_eq(std::ranges::count(hits, 1, [](const auto& hit){ return hit.load(); }), 1000l);
+        }
+    };
+
+    test_case("CrypticFile::ManyFiles, [cryptic]") = [] {
+        auto paths = std::vector<std::filesystem::path>{};
+        for(auto i = 0uz; i < 40uz; ++i)
+            paths.push_back(make_file("many-"s + std::to_string(i), i * 997uz));
+        paths.push_back(test_directory() / "missing");
+
+        auto pool = cryptic::file::thread_pool{3};
+        const auto results = cryptic::file::hash<cryptic::sha512_256>(paths, pool);
+        require_eq(results.size(), paths.size());
+        for(auto i = 0uz; i < 40uz; ++i)
+            require_eq(cryptic::base64::encode(results[i].value()), cryptic::sha512_256::base64(read_file(paths[i])));
+        require_eq(results.back().has_value(), false);
+
+        for(auto i = 0uz; i < 40uz; ++i)
+            std::filesystem::remove(paths[i]);
+    };
+
+    test_case("CrypticFile::Tree, [cryptic]") = [] {
+        // Three leaves: root = H(1 || H(1 || H(0 || a) || H(0 || b)) || H(0 || c))
+        const auto content = "aaaabbbbcc"s;
+        const auto leaf = [](const std::string& chunk){
+            auto hash = cryptic::sha256{};
+            hash.update("\x00"s);
+            hash.update(chunk);
+            return hash.finalize();
+        };
+        auto serial = cryptic::sha256{};
+        serial.update("\x01"s);
+        serial.update(leaf("aaaa"s));
+        serial.update(leaf("bbbb"s));
+        const auto left = serial.finalize();
+        serial.reset();
+        serial.update("\x01"s);
+        serial.update(left);
+        serial.update(leaf("cc"s));
+        const auto expected = cryptic::base64::encode(serial.finalize());
+
+        auto pool = cryptic::file::thread_pool{2};
+        require_eq(cryptic::base64::encode(cryptic::file::tree_hash<cryptic::sha256>(std::as_bytes(std::span{content}), pool, 4)), expected);
+
+        // A single leaf and the empty input
+        require_eq(cryptic::base64::encode(cryptic::file::tree_hash<cryptic::sha256>(std::as_bytes(std::span{content}), pool, 64)), cryptic::base64::encode(leaf(content)));
+        require_eq(cryptic::base64::encode(cryptic::file::tree_hash<cryptic::sha256>(std::span<const std::byte>{}, pool)), cryptic::base64::encode(leaf(""s)));
+    };
+
+    test_case("CrypticFile::TreeReproducible, [cryptic]") = [] {
+        // The same root from memory, from pread() leaves and from a mapping, for any thread count
+        for(const auto size : {5000uz, cryptic::file::mmap_threshold * 3uz + 17uz})
+        {
+            const auto path = make_file("tree-"s + std::to_string(size), size);
+            const auto content = read_file(path);
+            auto single = cryptic::file::thread_pool{1};
+            const auto expected = cryptic::file::tree_hash<cryptic::sha1>(std::as_bytes(std::span{content}), single, 1000);
+
+            for(const auto threads : {1u, 2u, 7u})
+            {
+                auto pool = cryptic::file::thread_pool{threads};
+                const auto root = cryptic::file::tree_hash<cryptic::sha1>(path, pool, 1000);
+                require_eq(cryptic::base64::encode(root.value()), cryptic::base64::encode(expected));
+            }
+            std::filesystem::remove(path);
+        }
+    };
+
+    return 0;
+}
+
+} // namespace cryptic::file_test
+
+const auto _ = cryptic::file_test::register_tests();
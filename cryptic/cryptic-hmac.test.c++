@@ -0,0 +1,145 @@
+// Copyright (c) 2025-2026 Kaius Ruokonen. All rights reserved.
+// SPDX-License-Identifier: MIT
+// See the LICENSE file in the project root for full license text.
+
+import std;
+import cryptic;
+import tester;
+
+using namespace std::string_literals;
+
+namespace cryptic::hmac_test {
+
+std::string hexadecimal(std::span<const std::byte> bytes)
+{
+    constexpr auto hex_chars = "0123456789abcdef";
+    auto result = std::string{};
+    for(auto byte : bytes)
+    {
+        result.push_back(hex_chars[std::to_integer<unsigned>(byte) >> 4]);
+        result.push_back(hex_chars[std::to_integer<unsigned>(byte) bitand 0xFu]);
+    }
+    return result;
+}
+
+// 0x00, 0x01, ... like the octet sequences of the RFC 5869 test cases
+std::string sequence(unsigned char first, std::size_t count)
+{
+    auto result = std::string(count, '\0');
+    std::iota(result.begin(), result.end(), static_cast<char>(first));
+    return result;
+}
+
+auto register_tests()
+{
+    using tester::basic::test_case;
+    using namespace tester::assertions;
+
+    test_case("CrypticHMAC::SHA256, [cryptic]") = [] {
+        // RFC 4231 test cases 1, 2 and 6
+        require_eq(hexadecimal(cryptic::hmac_sha256{std::string(20, '\x0b')}.sign("Hi There"s)),
+                   "b0344c61d8db38535ca8afceaf0bf12b881dc200c9833da726e9376c2e32cff7"s);
+        require_eq(hexadecimal(cryptic::hmac_sha256{"Jefe"s}.sign("what do ya want for nothing?"s)),
+                   "5bdcc146bf60754e6a042426089575c75a003f089d2739839dec58b964ec3843"s);
+        require_eq(hexadecimal(cryptic::hmac_sha256{std::string(131, '\xaa')}.sign("Test Using Larger Than Block-Size Key - Hash Key First"s)),
+                   "60e431591ee0b67f0d8a26aacbf5b77f8e0bc6213728c5140546040f0ee37f54"s);
+    };
+
+    test_case("CrypticHMAC::OtherHashes, [cryptic]") = [] {
+        require_eq(hexadecimal(cryptic::hmac_sha1{"Jefe"s}.sign("what do ya want for nothing?"s)),
+                   "effcdf6ae5eb2fa2d27416d5f184df9c259a7c79"s);
+        require_eq(hexadecimal(cryptic::hmac_sha384{"Jefe"s}.sign("what do ya want for nothing?"s)),
+                   "af45d2e376484031617f78d2b58a6b1b9c7ef464f5a01b47e42ec3736322445e8e2240ca5e69e2c78b3239ecfab21649"s);
+        require_eq(hexadecimal(cryptic::hmac_sha512{"Jefe"s}.sign("what do ya want for nothing?"s)),
+                   "164b7a7bfcf819e2e395fbe73b56e0a387bd64222e831fd610270cd7ea2505549758bf75c05a994a6d034f65f8f0e6fdcaeab1a34d4a6b4b636e070a38bce737"s);
+        require_eq(hexadecimal(cryptic::hmac_sha512{std::string(131, '\xaa')}.sign("Test Using Larger Than Block-Size Key - Hash Key First"s)),
+                   "80b24263c7c1a3ebb71493c1dd7be8b49b46d1f41b4aeec1121b013783f8f3526b56d037e05f2598bd0fd2215d6a1e5295e64f73f63f0aec8b915a985d786598"s);
+    };
+
+    test_case("CrypticHMAC::Streaming, [cryptic]") = [] {
+        auto hmac = cryptic::hmac_sha256{"Jefe"s};
+        hmac.update("what do ya "s);
+        hmac.update("want for nothing?"s);
+        require_eq(hexadecimal(hmac.finalize()), "5bdcc146bf60754e6a042426089575c75a003f089d2739839dec58b964ec3843"s);
+
+        // finalize() rearms the keyed object for the next message
+        hmac.update("what do ya want for nothing?"s);
+        require_eq(hexadecimal(hmac.finalize()), "5bdcc146bf60754e6a042426089575c75a003f089d2739839dec58b964ec3843"s);
+    };
+
+    test_case("CrypticHMAC::Assignment, [cryptic]") = [] {
+        // Keyed objects are regular values: reassigned in place and kept in containers
+        auto hmac = cryptic::hmac_sha256{"key"s};
+        hmac.update("what do ya "s);
+        hmac = cryptic::hmac_sha256{"Jefe"s};
+        hmac.update("what do ya want for nothing?"s);
+        require_eq(hexadecimal(hmac.finalize()), "5bdcc146bf60754e6a042426089575c75a003f089d2739839dec58b964ec3843"s);
+
+        auto keys = std::vector<cryptic::hmac_sha256>(2, hmac);
+        keys[1] = cryptic::hmac_sha256{"key"s};
+        keys.erase(keys.begin());
+        keys.push_back(hmac);
+        require_eq(hexadecimal(keys[0].sign("The quick brown fox jumps over the lazy dog"s)),
+                   "f7bc83f430538424b13298e6aa6fb143ef4d59a14946175997479dbc2d1a3cd8"s);
+        require_eq(hexadecimal(keys[1].sign("what do ya want for nothing?"s)),
+                   "5bdcc146bf60754e6a042426089575c75a003f089d2739839dec58b964ec3843"s);
+    };
+
+    test_case("CrypticHMAC::Verify, [cryptic]") = [] {
+        const auto hmac = cryptic::hmac_sha256{"Jefe"s};
+        auto tag = hmac.sign("what do ya want for nothing?"s);
+
+        require_eq(hmac.verify("what do ya want for nothing?"s, tag), true);
+        require_eq(hmac.verify("what do ya want for nothing!"s, tag), false);
+        require_eq(hmac.verify("what do ya want for nothing?"s, std::span{tag}.first(16)), false);
+
+        tag[31] = tag[31] xor std::byte{0b00000001};
+        require_eq(hmac.verify("what do ya want for nothing?"s, tag), false);
+    };
+
+    test_case("CrypticHMAC::PBKDF2, [cryptic]") = [] {
+        // RFC 6070
+        auto derived20 = std::array<std::byte, 20>{};
+        cryptic::hmac_sha1::pbkdf2("password"s, "salt"s, 1, derived20);
+        require_eq(hexadecimal(derived20), "0c60c80f961f0e71f3a9b524af6012062fe037a6"s);
+        cryptic::hmac_sha1::pbkdf2("password"s, "salt"s, 4096, derived20);
+        require_eq(hexadecimal(derived20), "4b007901b765489abead49d926f721d065a429c1"s);
+
+        auto derived25 = std::array<std::byte, 25>{};
+        cryptic::hmac_sha1::pbkdf2("passwordPASSWORDpassword"s, "saltSALTsaltSALTsaltSALTsaltSALTsalt"s, 4096, derived25);
+        require_eq(hexadecimal(derived25), "3d2eec4fe41c849b80c8d83662c0e44a8b291a964cf2f07038"s);
+
+        // RFC 7914, section 11
+        auto derived64 = std::array<std::byte, 64>{};
+        cryptic::hmac_sha256::pbkdf2("passwd"s, "salt"s, 1, derived64);
+        require_eq(hexadecimal(derived64), "55ac046e56e3089fec1691c22544b605f94185216dde0465e68b9d57c20dacbc49ca9cccf179b645991664b39d77ef317c71b845b1e30bd509112041d3a19783"s);
+
+        auto derived32 = std::array<std::byte, 32>{};
+        cryptic::hmac_sha256::pbkdf2("password"s, "salt"s, 4096, derived32);
+        require_eq(hexadecimal(derived32), "c5e478d59288c841aa530db6845c4c8d962893a001ce4e11a4963873aa98134a"s);
+    };
+
+    test_case("CrypticHMAC::HKDF, [cryptic]") = [] {
+        // RFC 5869 test case 1
+        const auto prk = cryptic::hmac_sha256::hkdf_extract(sequence(0x00, 13), std::string(22, '\x0b'));
+        require_eq(hexadecimal(prk), "077709362c2e32df0ddc3f0dc47bba6390b6c73bb50f9c3122ec844ad7c2b3e5"s);
+
+        auto okm = std::array<std::byte, 42>{};
+        cryptic::hmac_sha256::hkdf_expand(prk, sequence(0xf0, 10), okm);
+        require_eq(hexadecimal(okm), "3cb25f25faacd57a90434f64d0362f2a2d2d0a90cf1a5a4c5db02d56ecc4c5bf34007208d5b887185865"s);
+
+        // RFC 5869 test case 3, empty salt and info
+        cryptic::hmac_sha256::hkdf(""s, std::string(22, '\x0b'), ""s, okm);
+        require_eq(hexadecimal(okm), "8da4e775a563c18f715f802a063c5a31b8a11f5c5ee1879ec3454e5f3c738d2d9d201395faa4b61a96c8"s);
+
+        // RFC 5869 test case 4
+        cryptic::hmac_sha1::hkdf(sequence(0x00, 13), std::string(11, '\x0b'), sequence(0xf0, 10), okm);
+        require_eq(hexadecimal(okm), "085a01ea1b10f36933068b56efa5ad81a4f14b822f5b091568a9cdd4f155fda2c22e422478d305f3f896"s);
+    };
+
+    return 0;
+}
+
+} // namespace cryptic::hmac_test
+
+const auto _ = cryptic::hmac_test::register_tests();
@@ -90,10 +90,128 @@ auto register_tests()
         require_eq(cryptic::sha1::hexadecimal(bytes), "a9993e364706816aba3e25717850c26c9cd0d89d"s);
     };
 
-    test_case("CrypticSHA1::LongMessage") = [] {
+    test_case("CrypticSHA1::LongMessage, [cryptic]") = [] {
         // One million 'a's - known test vector
         std::string million(1'000'000, 'a');
-        require_eq(cryptic::sha1::hexadecimal(million), "a048fad61afde325fdf0cdd04e6302cf6a2344dd"s);
+        require_eq(cryptic::sha1::hexadecimal(million), "34aa973cd4c4daa4f61eeb2bdbad27316534016f"s);
+    };
+
+    test_case("CrypticSHA1::BlockBoundary, [cryptic]") = [] {
+        // Messages filling whole chunks still need a separate padding block
+        require_eq(cryptic::sha1::hexadecimal(std::string(64, 'a')), "0098ba824b5c16427bd7a1122a5a442a25ec644d"s);
+    };
+
+    test_case("CrypticSHA1::Streaming, [cryptic]") = [] {
+        auto sha1 = cryptic::sha1{};
+        sha1.update("The quick brown "s);
+        sha1.update("fox jumps over "s);
+        sha1.update("the lazy dog"s);
+        const auto digest = sha1.finalize();
+
+        require_eq(sha1.hexadecimal(), "2fd4e1c67a2d28fced849ee1bb76e7391b93eb12"s);
+        require_eq(cryptic::base64::encode(digest), "L9ThxnotKPzthJ7hu3bnORuT6xI="s);
+
+        // Uneven pieces that straddle chunk boundaries
+        const auto million = std::string(1'000'000, 'a');
+        auto bytes = std::as_bytes(std::span{million});
+        sha1.reset();
+        for(auto piece = 1uz; not bytes.empty(); piece = piece * 3 % 257 + 1)
+        {
+            const auto count = std::min(piece, bytes.size());
+            sha1.update(bytes.first(count));
+            bytes = bytes.subspan(count);
+        }
+        sha1.finalize();
+        require_eq(sha1.hexadecimal(), "34aa973cd4c4daa4f61eeb2bdbad27316534016f"s);
+
+        sha1.reset();
+        sha1.finalize();
+        require_eq(sha1.hexadecimal(), "da39a3ee5e6b4b0d3255bfef95601890afd80709"s);
+    };
+
+    test_case("CrypticSHA1::Clone, [cryptic]") = [] {
+        auto prefix = cryptic::sha1{};
+        prefix.update("The quick brown fox jumps over the lazy "s);
+
+        auto dog = prefix.clone();
+        auto cog = prefix.clone();
+        dog.update("dog"s);
+        cog.update("cog"s);
+        dog.finalize();
+        cog.finalize();
+
+        require_eq(dog.hexadecimal(), "2fd4e1c67a2d28fced849ee1bb76e7391b93eb12"s);
+        require_eq(cog.hexadecimal(), "de9f2c7fd25e1b3afad3e85a0bd17d9b100db4b3"s);
+    };
+
+    test_case("CrypticSHA1::Backends, [cryptic]") = [] {
+        // The same vectors through the detected (possibly SHA-NI) backend and the portable scalar one
+        for(auto sha : {true, false})
+        {
+            auto subset = cryptic::cpu::features();
+            subset.sha = sha;
+            const auto backend = cryptic::cpu::scoped_features{subset};
+            require_eq(cryptic::sha1::hexadecimal(""), "da39a3ee5e6b4b0d3255bfef95601890afd80709"s);
+            require_eq(cryptic::sha1::hexadecimal("abc"), "a9993e364706816aba3e25717850c26c9cd0d89d"s);
+            require_eq(cryptic::sha1::hexadecimal("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq"), "84983e441c3bd26ebaae4aa1f95129e5e54670f1"s);
+            require_eq(cryptic::sha1::hexadecimal(std::string(64, 'a')), "0098ba824b5c16427bd7a1122a5a442a25ec644d"s);
+            require_eq(cryptic::sha1::hexadecimal(std::string(1'000'000, 'a')), "34aa973cd4c4daa4f61eeb2bdbad27316534016f"s);
+        }
+
+        // Every length across a few chunk boundaries must agree between the backends
+        auto message = std::string{};
+        auto sha1 = std::vector<std::string>{};
+        for(auto i = 0uz; i < 300uz; ++i)
+        {
+            sha1.push_back(cryptic::sha1::hexadecimal(message));
+            message.push_back(static_cast<char>(i * 7 + 3));
+        }
+        auto scalar = cryptic::cpu::features();
+        scalar.sha = false;
+        const auto backend = cryptic::cpu::scoped_features{scalar};
+        message.clear();
+        for(auto i = 0uz; i < 300uz; ++i)
+        {
+            require_eq(cryptic::sha1::hexadecimal(message), sha1[message.size()]);
+            message.push_back(static_cast<char>(i * 7 + 3));
+        }
+    };
+
+    test_case("CrypticSHA1::Batch, [cryptic]") = [] {
+        // Mixed lengths so that lanes finish early, get refilled and finally sit masked
+        auto messages = std::vector<std::string>{};
+        for(auto i = 0uz; i < 100uz; ++i)
+            messages.push_back(std::string(i * 37 % 300, static_cast<char>('a' + i % 26)));
+        messages.push_back(std::string(1'000, 'z'));
+
+        auto spans = std::vector<std::span<const std::byte>>{};
+        for(const auto& message : messages)
+            spans.push_back(std::as_bytes(std::span{message}));
+
+        // AVX-512, AVX2 and SSSE3 lanes and the one-by-one fallbacks, as far as the CPU allows
+        for(auto [avx512, avx2, ssse3, sha] : {std::tuple{true, true, true, true},
+                                               std::tuple{false, true, true, false},
+                                               std::tuple{false, false, true, false},
+                                               std::tuple{false, false, true, true},
+                                               std::tuple{false, false, false, false}})
+        {
+            auto subset = cryptic::cpu::features();
+            subset.avx512 = avx512;
+            subset.avx2 = avx2;
+            subset.ssse3 = ssse3;
+            subset.sha = sha;
+            const auto backend = cryptic::cpu::scoped_features{subset};
+            auto sha1 = std::vector<cryptic::sha1::buffer_type>(messages.size());
+            cryptic::sha1::hash_batch(spans, sha1);
+            for(auto i = 0uz; i < messages.size(); ++i)
+                require_eq(cryptic::base64::encode(sha1[i]), cryptic::sha1::base64(messages[i]));
+        }
+
+        const auto abc = std::string{"abc"};
+        auto single = std::array<std::span<const std::byte>, 1>{std::as_bytes(std::span{abc})};
+        auto digest = std::array<cryptic::sha1::buffer_type, 1>{};
+        cryptic::sha1::hash_batch(single, digest);
+        require_eq(cryptic::base64::encode(digest[0]), cryptic::sha1::base64(abc));
     };
 
     test_case("CrypticSHA1::Comparison") = [] {
@@ -106,6 +224,70 @@ auto register_tests()
         require_neq(hash1 < hash2, hash2 < hash1); // One must be true
     };
 
+    test_case("CrypticSHA1::Ordering, [cryptic]") = [] {
+        // Equal digests compare equal instead of reading past the five state words
+        const auto hash = cryptic::sha1{"abc"s};
+        const auto same = cryptic::sha1{"abc"s};
+        require_eq(hash < same, false);
+        require_eq(same < hash, false);
+
+        // Same order as the digest bytes
+        for(auto i = 0; i < 200; ++i)
+        {
+            const auto a = cryptic::sha1{std::to_string(i)};
+            const auto b = cryptic::sha1{std::to_string(i + 1)};
+            require_eq(a < b, a.digest() < b.digest());
+            require_eq(a < std::span<const std::byte, 20>{b.digest()}, a.digest() < b.digest());
+        }
+    };
+
+    test_case("CrypticSHA1::Compress, [cryptic]") = [] {
+        // "abc" padded by hand into a single chunk
+        auto padded = std::array<std::byte, 64>{std::byte{'a'}, std::byte{'b'}, std::byte{'c'}, std::byte{0b10000000}};
+        padded[63] = std::byte{24};
+        const auto abc = cryptic::sha1::state_type{0xa9993e36u, 0x4706816au, 0xba3e2571u, 0x7850c26cu, 0x9cd0d89du};
+
+        // Independent states through one scheduled chunk, interleaved with SHA-NI, must match
+        // the scalar rounds state by state
+        auto generator = std::mt19937{3174};
+        auto chunk = std::array<std::byte, 64>{};
+        for(auto& byte : chunk)
+            byte = static_cast<std::byte>(generator());
+        const auto words = cryptic::sha1::schedule(chunk);
+        auto states = std::array<cryptic::sha1::state_type, 3>{};
+        for(auto& state : states)
+            for(auto& word : state)
+                word = generator();
+        auto expected = states;
+        {
+            const auto scalar = cryptic::cpu::scoped_features{{}};
+            cryptic::sha1::compress(expected, words);
+        }
+
+        for(auto sha : {true, false})
+        {
+            auto subset = cryptic::cpu::features();
+            subset.sha = sha;
+            const auto backend = cryptic::cpu::scoped_features{subset};
+
+            auto state = cryptic::sha1::initial_digest;
+            cryptic::sha1::compress(state, padded);
+            require_eq(state, abc);
+            state = cryptic::sha1::initial_digest;
+            cryptic::sha1::compress(state, cryptic::sha1::schedule(padded));
+            require_eq(state, abc);
+
+            auto pair = std::array{states[0], states[1]};
+            cryptic::sha1::compress(pair, words);
+            require_eq(pair[0], expected[0]);
+            require_eq(pair[1], expected[1]);
+
+            auto triple = states;
+            cryptic::sha1::compress(triple, words);
+            require_eq(triple, expected);
+        }
+    };
+
     return 0;
 }
 
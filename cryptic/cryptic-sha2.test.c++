@@ -124,10 +124,202 @@ auto register_tests()
         require_eq(cryptic::sha256::hexadecimal(str), "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad"s);
     };
 
-    test_case("CrypticSHA256::LongMessage") = [] {
+    test_case("CrypticSHA256::LongMessage, [cryptic]") = [] {
         // One million 'a's - known test vector
         std::string million(1'000'000, 'a');
-        require_eq(cryptic::sha256::hexadecimal(million), "7ada70eb68068a222f2f02c77f9376c270501a1fd25beac6280325fc2950ab39"s);
+        require_eq(cryptic::sha256::hexadecimal(million), "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0"s);
+    };
+
+    test_case("CrypticSHA2::BlockBoundary, [cryptic]") = [] {
+        // Messages filling whole chunks still need a separate padding block
+        require_eq(cryptic::sha224::hexadecimal(std::string(64, 'a')), "a88cd5cde6d6fe9136a4e58b49167461ea95d388ca2bdb7afdc3cbf4"s);
+        require_eq(cryptic::sha256::hexadecimal(std::string(128, 'a')), "6836cf13bac400e9105071cd6af47084dfacad4e5e302c94bfed24e013afb73e"s);
+    };
+
+    test_case("CrypticSHA256::Streaming, [cryptic]") = [] {
+        auto sha256 = cryptic::sha256{};
+        sha256.update("The quick brown "s);
+        sha256.update("fox jumps over "s);
+        sha256.update("the lazy dog"s);
+        const auto digest = sha256.finalize();
+
+        require_eq(sha256.hexadecimal(), "d7a8fbb307d7809469ca9abcb0082e4f8d5651e46d3cdb762d02d0bf37c9e592"s);
+        require_eq(cryptic::base64::encode(digest), "16j7swfXgJRpypq8sAguT41WUeRtPNt2LQLQvzfJ5ZI="s);
+
+        // Uneven pieces that straddle chunk boundaries
+        const auto million = std::string(1'000'000, 'a');
+        auto bytes = std::as_bytes(std::span{million});
+        sha256.reset();
+        for(auto piece = 1uz; not bytes.empty(); piece = piece * 3 % 257 + 1)
+        {
+            const auto count = std::min(piece, bytes.size());
+            sha256.update(bytes.first(count));
+            bytes = bytes.subspan(count);
+        }
+        sha256.finalize();
+        require_eq(sha256.hexadecimal(), "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0"s);
+
+        sha256.reset();
+        sha256.finalize();
+        require_eq(sha256.hexadecimal(), "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855"s);
+    };
+
+    test_case("CrypticSHA256::Clone, [cryptic]") = [] {
+        auto prefix = cryptic::sha256{};
+        prefix.update("The quick brown fox jumps over the lazy "s);
+
+        auto dog = prefix.clone();
+        auto cog = prefix.clone();
+        dog.update("dog"s);
+        cog.update("cog"s);
+        dog.finalize();
+        cog.finalize();
+
+        require_eq(dog.hexadecimal(), "d7a8fbb307d7809469ca9abcb0082e4f8d5651e46d3cdb762d02d0bf37c9e592"s);
+        require_eq(cog.hexadecimal(), "e4c4d8f3bf76b692de791a173e05321150f7a345b46484fe427f6acc7ecc81be"s);
+    };
+
+    test_case("CrypticSHA2::Backends, [cryptic]") = [] {
+        // The same vectors through the detected (possibly SHA-NI) backend and the portable scalar one
+        for(auto sha : {true, false})
+        {
+            auto subset = cryptic::cpu::features();
+            subset.sha = sha;
+            const auto backend = cryptic::cpu::scoped_features{subset};
+            require_eq(cryptic::sha224::hexadecimal(""), "d14a028c2a3a2bc9476102bb288234c415a2b01f828ea62ac5b3e42f"s);
+            require_eq(cryptic::sha224::hexadecimal("abc"), "23097d223405d8228642a477bda255b32aadbce4bda0b3f7e36c9da7"s);
+            require_eq(cryptic::sha256::hexadecimal(""), "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855"s);
+            require_eq(cryptic::sha256::hexadecimal("abc"), "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad"s);
+            require_eq(cryptic::sha256::hexadecimal("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq"), "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1"s);
+            require_eq(cryptic::sha256::hexadecimal(std::string(128, 'a')), "6836cf13bac400e9105071cd6af47084dfacad4e5e302c94bfed24e013afb73e"s);
+            require_eq(cryptic::sha256::hexadecimal(std::string(1'000'000, 'a')), "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0"s);
+        }
+
+        // Every length across a few chunk boundaries must agree between the backends
+        auto message = std::string{};
+        auto sha224 = std::vector<std::string>{};
+        auto sha256 = std::vector<std::string>{};
+        for(auto i = 0uz; i < 300uz; ++i)
+        {
+            sha224.push_back(cryptic::sha224::hexadecimal(message));
+            sha256.push_back(cryptic::sha256::hexadecimal(message));
+            message.push_back(static_cast<char>(i * 7 + 3));
+        }
+        auto scalar = cryptic::cpu::features();
+        scalar.sha = false;
+        const auto backend = cryptic::cpu::scoped_features{scalar};
+        message.clear();
+        for(auto i = 0uz; i < 300uz; ++i)
+        {
+            require_eq(cryptic::sha224::hexadecimal(message), sha224[message.size()]);
+            require_eq(cryptic::sha256::hexadecimal(message), sha256[message.size()]);
+            message.push_back(static_cast<char>(i * 7 + 3));
+        }
+    };
+
+    test_case("CrypticSHA2::Batch, [cryptic]") = [] {
+        // Mixed lengths so that lanes finish early, get refilled and finally sit masked
+        auto messages = std::vector<std::string>{};
+        for(auto i = 0uz; i < 100uz; ++i)
+            messages.push_back(std::string(i * 37 % 300, static_cast<char>('a' + i % 26)));
+        messages.push_back(std::string(1'000, 'z'));
+
+        auto spans = std::vector<std::span<const std::byte>>{};
+        for(const auto& message : messages)
+            spans.push_back(std::as_bytes(std::span{message}));
+
+        // AVX-512, AVX2 and SSSE3 lanes and the one-by-one fallbacks, as far as the CPU allows
+        for(auto [avx512, avx2, ssse3, sha] : {std::tuple{true, true, true, true},
+                                               std::tuple{false, true, true, false},
+                                               std::tuple{false, false, true, false},
+                                               std::tuple{false, false, true, true},
+                                               std::tuple{false, false, false, false}})
+        {
+            auto subset = cryptic::cpu::features();
+            subset.avx512 = avx512;
+            subset.avx2 = avx2;
+            subset.ssse3 = ssse3;
+            subset.sha = sha;
+            const auto backend = cryptic::cpu::scoped_features{subset};
+            auto sha224 = std::vector<cryptic::sha224::buffer_type>(messages.size());
+            cryptic::sha224::hash_batch(spans, sha224);
+            for(auto i = 0uz; i < messages.size(); ++i)
+                require_eq(cryptic::base64::encode(sha224[i]), cryptic::sha224::base64(messages[i]));
+            auto sha256 = std::vector<cryptic::sha256::buffer_type>(messages.size());
+            cryptic::sha256::hash_batch(spans, sha256);
+            for(auto i = 0uz; i < messages.size(); ++i)
+                require_eq(cryptic::base64::encode(sha256[i]), cryptic::sha256::base64(messages[i]));
+        }
+
+        const auto abc = std::string{"abc"};
+        auto single = std::array<std::span<const std::byte>, 1>{std::as_bytes(std::span{abc})};
+        auto digest = std::array<cryptic::sha256::buffer_type, 1>{};
+        cryptic::sha256::hash_batch(single, digest);
+        require_eq(cryptic::base64::encode(digest[0]), cryptic::sha256::base64(abc));
+    };
+
+    test_case("CrypticSHA512::StandardVectors, [cryptic]") = [] {
+        auto hash = cryptic::sha512{};
+        require_eq(64ul, hash.size());
+
+        require_eq(cryptic::sha512::hexadecimal(""), "cf83e1357eefb8bdf1542850d66d8007d620e4050b5715dc83f4a921d36ce9ce47d0d13c5d85f2b0ff8318d2877eec2f63b931bd47417a81a538327af927da3e"s);
+        require_eq(cryptic::sha512::hexadecimal("abc"), "ddaf35a193617abacc417349ae20413112e6fa4e89a97ea20a9eeee64b55d39a2192992a274fc1a836ba3c23a3feebbd454d4423643ce80e2a9ac94fa54ca49f"s);
+        require_eq(cryptic::sha512::hexadecimal("abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu"), "8e959b75dae313da8cf4f72814fc143f8f7779c6eb9f7fa17299aeadb6889018501d289e4900f7e4331b99dec4b5433ac7d329eeb6dd26545e96e55b874be909"s);
+        require_eq(cryptic::sha512::base64("The quick brown fox jumps over the lazy dog"s), "B+VH2VhvanP3P7rAQ17XaVEhj7fQyNeIownXhUNru2Quk6JSqVTyORJUfR6KO17W4b/XCXghIz+gU489uFT+5g=="s);
+    };
+
+    test_case("CrypticSHA384::StandardVectors, [cryptic]") = [] {
+        auto hash = cryptic::sha384{};
+        require_eq(48ul, hash.size());
+
+        require_eq(cryptic::sha384::hexadecimal(""), "38b060a751ac96384cd9327eb1b1e36a21fdb71114be07434c0cc7bf63f6e1da274edebfe76f65fbd51ad2f14898b95b"s);
+        require_eq(cryptic::sha384::hexadecimal("abc"), "cb00753f45a35e8bb5a03d699ac65007272c32ab0eded1631a8b605a43ff5bed8086072ba1e7cc2358baeca134c825a7"s);
+        require_eq(cryptic::sha384::hexadecimal("abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu"), "09330c33f71147e83d192fc782cd1b4753111b173b3b05d22fa08086e3b0f712fcc7c71a557e2db966c3e9fa91746039"s);
+    };
+
+    test_case("CrypticSHA512_256::StandardVectors, [cryptic]") = [] {
+        auto hash = cryptic::sha512_256{};
+        require_eq(32ul, hash.size());
+
+        require_eq(cryptic::sha512_256::hexadecimal(""), "c672b8d1ef56ed28ab87c3622c5114069bdd3ad7b8f9737498d0c01ecef0967a"s);
+        require_eq(cryptic::sha512_256::hexadecimal("abc"), "53048e2681941ef99b2e29b76b4c7dabe4c2d0c634fc6d46e0e2f13107e7af23"s);
+        require_eq(cryptic::sha512_256::hexadecimal("abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu"), "3928e184fb8690f840da3988121d31be65cb9d3ef83ee6146feac861e19b563a"s);
+    };
+
+    test_case("CrypticSHA512::LongMessage, [cryptic]") = [] {
+        const auto million = std::string(1'000'000, 'a');
+        require_eq(cryptic::sha512::hexadecimal(million), "e718483d0ce769644e2e42c7bc15b4638e1f98b13b2044285632a803afa973ebde0ff244877ea60a4cb0432ce577c31beb009c5c2c49aa2e4eadb217ad8cc09b"s);
+        require_eq(cryptic::sha384::hexadecimal(million), "9d0e1809716474cb086e834e310a4a1ced149e9c00f248527972cec5704c2a5b07b8b3dc38ecc4ebae97ddd87f3d8985"s);
+        require_eq(cryptic::sha512_256::hexadecimal(million), "9a59a052930187a97038cae692f30708aa6491923ef5194394dc68d56c74fb21"s);
+    };
+
+    test_case("CrypticSHA512::BlockBoundary, [cryptic]") = [] {
+        // 128-byte chunks: a full chunk still needs a separate padding block
+        require_eq(cryptic::sha512::hexadecimal(std::string(128, 'a')), "b73d1929aa615934e61a871596b3f3b33359f42b8175602e89f7e06e5f658a243667807ed300314b95cacdd579f3e33abdfbe351909519a846d465c59582f321"s);
+        require_eq(cryptic::sha384::hexadecimal(std::string(128, 'a')), "edb12730a366098b3b2beac75a3bef1b0969b15c48e2163c23d96994f8d1bef760c7e27f3c464d3829f56c0d53808b0b"s);
+        require_eq(cryptic::sha512_256::hexadecimal(std::string(128, 'a')), "b88f97e274f9c1d49f181c8cbd01a9c74930ad055a46ac4499a1d601f1c80bf2"s);
+    };
+
+    test_case("CrypticSHA512::Streaming, [cryptic]") = [] {
+        const auto million = std::string(1'000'000, 'a');
+        auto bytes = std::as_bytes(std::span{million});
+        auto sha512_256 = cryptic::sha512_256{};
+        for(auto piece = 1uz; not bytes.empty(); piece = piece * 3 % 257 + 1)
+        {
+            const auto count = std::min(piece, bytes.size());
+            sha512_256.update(bytes.first(count));
+            bytes = bytes.subspan(count);
+        }
+        const auto digest = sha512_256.finalize();
+        require_eq(sha512_256.hexadecimal(), "9a59a052930187a97038cae692f30708aa6491923ef5194394dc68d56c74fb21"s);
+        require_eq(cryptic::base64::encode(digest), cryptic::sha512_256::base64(million));
+
+        auto prefix = cryptic::sha512{};
+        prefix.update("The quick brown fox jumps over the lazy "s);
+        auto dog = prefix.clone();
+        dog.update("dog"s);
+        dog.finalize();
+        require_eq(dog.base64(), "B+VH2VhvanP3P7rAQ17XaVEhj7fQyNeIownXhUNru2Quk6JSqVTyORJUfR6KO17W4b/XCXghIz+gU489uFT+5g=="s);
     };
 
     test_case("CrypticSHA256::Comparison") = [] {
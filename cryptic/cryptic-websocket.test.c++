@@ -0,0 +1,104 @@
+// Copyright (c) 2025-2026 Kaius Ruokonen. All rights reserved.
+// SPDX-License-Identifier: MIT
+// See the LICENSE file in the project root for full license text.
+
+import std;
+import cryptic;
+import tester;
+
+using namespace std::string_literals;
+using namespace std::string_view_literals;
+
+namespace cryptic::websocket_test {
+
+std::string to_string(const cryptic::websocket::accept_type& accept)
+{
+    return {accept.data(), accept.size()};
+}
+
+// The handshake as written before the fast path: concatenate and hash generically
+std::string reference(std::string_view key)
+{
+    return cryptic::sha1::base64(std::string{key} + std::string{cryptic::websocket::guid});
+}
+
+// Random 16-byte nonces in base64, as browsers send them
+std::vector<std::string> make_keys(std::size_t count)
+{
+    auto keys = std::vector<std::string>{};
+    auto generator = std::mt19937_64{6455};
+    for(auto i = 0uz; i < count; ++i)
+    {
+        auto nonce = std::string(16, '\0');
+        for(auto& c : nonce)
+            c = static_cast<char>(generator());
+        keys.push_back(cryptic::base64::encode(nonce));
+    }
+    return keys;
+}
+
+auto register_tests()
+{
+    using tester::basic::test_case;
+    using namespace tester::assertions;
+
+    test_case("CrypticWebSocket::AcceptKey, [cryptic]") = [] {
+        // RFC 6455 section 1.3
+        require_eq(to_string(cryptic::websocket::accept_key("dGhlIHNhbXBsZSBub25jZQ=="sv)), "s3pPLMBiTxaQ9kYGzzhZRbK+xOo="s);
+        require_eq(to_string(cryptic::websocket::accept_key("omQGMC65WBEzzZAX7H8l+g=="sv)), reference("omQGMC65WBEzzZAX7H8l+g=="sv));
+
+        for(const auto sha : {true, false})
+        {
+            auto subset = cryptic::cpu::features();
+            subset.sha = sha;
+            const auto backend = cryptic::cpu::scoped_features{subset};
+            for(const auto& key : make_keys(200))
+                require_eq(to_string(cryptic::websocket::accept_key(key)), reference(key));
+        }
+    };
+
+    test_case("CrypticWebSocket::AnyLength, [cryptic]") = [] {
+        // Other lengths skip the fixed layout but are still answered per RFC 6455
+        for(const auto key : {""sv, "x"sv, "dGhlIHNhbXBsZSBub25jZQ="sv, "dGhlIHNhbXBsZSBub25jZQ==="sv, "a-much-longer-key-than-any-browser-would-send-0123456789"sv})
+            require_eq(to_string(cryptic::websocket::accept_key(key)), reference(key));
+    };
+
+    test_case("CrypticWebSocket::ValidKey, [cryptic]") = [] {
+        require_eq(cryptic::websocket::valid_key("dGhlIHNhbXBsZSBub25jZQ=="sv), true);
+        require_eq(cryptic::websocket::valid_key("dGhlIHNhbXBsZSBub25jZQ="sv), false);
+        require_eq(cryptic::websocket::valid_key("dGhlIHNhbXBsZSBub25jZQ!="sv), false);
+        require_eq(cryptic::websocket::valid_key("dGhlIHNhbXBsZSBub25jZQBu"sv), false);
+        for(const auto& key : make_keys(20))
+            require_eq(cryptic::websocket::valid_key(key), true);
+    };
+
+    test_case("CrypticWebSocket::AcceptKeys, [cryptic]") = [] {
+        // Odd group sizes and keys of other lengths mixed in, on every backend
+        auto keys = make_keys(101);
+        keys[7] = "short"s;
+        keys[50] = "dGhlIHNhbXBsZSBub25jZQ==="s;
+        const auto views = std::vector<std::string_view>(keys.begin(), keys.end());
+
+        for(const auto& [sha, avx512, avx2] : {std::tuple{true, true, true}, {false, true, true}, {false, false, true}, {false, false, false}})
+        {
+            auto subset = cryptic::cpu::features();
+            subset.sha = sha;
+            subset.avx512 = avx512;
+            subset.avx2 = avx2;
+            const auto backend = cryptic::cpu::scoped_features{subset};
+            for(const auto count : {0uz, 1uz, 3uz, 4uz, 17uz, views.size()})
+            {
+                auto accepts = std::vector<cryptic::websocket::accept_type>(count);
+                cryptic::websocket::accept_keys(std::span{views}.first(count), accepts);
+                for(auto i = 0uz; i < count; ++i)
+                    require_eq(to_string(accepts[i]), reference(views[i]));
+            }
+        }
+    };
+
+    return 0;
+}
+
+} // namespace cryptic::websocket_test
+
+const auto _ = cryptic::websocket_test::register_tests();
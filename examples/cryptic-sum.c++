@@ -0,0 +1,380 @@
+// Copyright (c) 2025-2026 Kaius Ruokonen. All rights reserved.
+// SPDX-License-Identifier: MIT
+// See the LICENSE file in the project root for full license text.
+
+// cryptic-sum - print or check SHA checksums, output-compatible with sha1sum/sha256sum.
+// Files are hashed in parallel; --tree splits every file into leaves hashed on all cores.
+// Linked or copied as sha1sum, sha224sum, ... it picks the algorithm from its name.
+
+import std;
+import cryptic;
+
+using namespace std::literals;
+
+namespace {
+
+struct options
+{
+    std::string program = "cryptic-sum"s;
+    std::string algorithm = "sha256"s;
+    unsigned jobs = std::max(1u, std::thread::hardware_concurrency());
+    std::size_t tree = 0uz; // leaf size, zero for plain digests
+    bool check = false;
+    std::vector<std::string> files = {};
+};
+
+// Files are hashed in batches so output starts early and memory stays bounded
+constexpr auto batch_size = 4096uz;
+
+void usage(const options& options)
+{
+    std::cout << "Usage: " << options.program << " [OPTION]... [FILE]...\n"
+              << "Print or check SHA checksums. With no FILE, or when FILE is -, read standard input.\n\n"
+              << "  -a, --algorithm=NAME  sha1, sha224, sha256 (default), sha384, sha512 or sha512-256\n"
+              << "  -c, --check           read checksums from the FILEs and check them\n"
+              << "  -j, --jobs=N          hash N files at a time (default: number of cores)\n"
+              << "      --tree[=BYTES]    chunked tree digest, leaves of BYTES (default 1 MiB) hashed in parallel;\n"
+              << "                        the root differs from the plain digest\n"
+              << "      --help            display this help and exit\n";
+}
+
+std::string hexadecimal(std::span<const std::byte> bytes)
+{
+    constexpr auto hex_chars = "0123456789abcdef";
+    auto result = std::string{};
+    result.reserve(2uz * bytes.size());
+    for(auto byte : bytes)
+    {
+        result.push_back(hex_chars[std::to_integer<unsigned>(byte) >> 4]);
+        result.push_back(hex_chars[std::to_integer<unsigned>(byte) bitand 0xFu]);
+    }
+    return result;
+}
+
+// coreutils escapes names holding a backslash, newline or carriage return and flags the line with a leading backslash
+bool escape(std::string_view name, std::string& result)
+{
+    const auto special = name.find_first_of("\\\n\r"sv) != std::string_view::npos;
+    for(auto c : name)
+    {
+        if (c == '\\' and special) result += "\\\\"sv;
+        else if (c == '\n' and special) result += "\\n"sv;
+        else if (c == '\r' and special) result += "\\r"sv;
+        else result.push_back(c);
+    }
+    return special;
+}
+
+// coreutils --check escapes a name in its status lines only when it holds a newline
+std::string status_name(std::string_view name)
+{
+    if (name.find('\n') == std::string_view::npos)
+        return std::string{name};
+    auto result = "\\"s;
+    escape(name, result);
+    return result;
+}
+
+std::optional<std::string> unescape(std::string_view name)
+{
+    auto result = std::string{};
+    for(auto i = 0uz; i < name.size(); ++i)
+    {
+        if (name[i] != '\\')
+        {
+            result.push_back(name[i]);
+            continue;
+        }
+        if (++i == name.size())
+            return std::nullopt;
+        if (name[i] == '\\') result.push_back('\\');
+        else if (name[i] == 'n') result.push_back('\n');
+        else if (name[i] == 'r') result.push_back('\r');
+        else return std::nullopt;
+    }
+    return result;
+}
+
+std::filesystem::path to_path(const std::string& name)
+{
+    return name == "-"s ? std::filesystem::path{"/dev/stdin"s} : std::filesystem::path{name};
+}
+
+template<typename Hash>
+std::vector<cryptic::file::result<Hash>> digests(std::span<const std::filesystem::path> paths, cryptic::file::thread_pool& pool, const options& options)
+{
+    if (options.tree == 0uz)
+        return cryptic::file::hash<Hash>(paths, pool);
+
+    // Tree mode: one file at a time, its leaves spread over the pool
+    auto results = std::vector<cryptic::file::result<Hash>>{};
+    for(const auto& path : paths)
+        results.push_back(cryptic::file::tree_hash<Hash>(path, pool, options.tree));
+    return results;
+}
+
+template<typename Hash>
+int sum(const options& options, cryptic::file::thread_pool& pool)
+{
+    auto status = 0;
+    auto files = std::span{options.files};
+    while (not files.empty())
+    {
+        const auto batch = files.first(std::min(batch_size, files.size()));
+        files = files.subspan(batch.size());
+
+        auto paths = std::vector<std::filesystem::path>{};
+        std::ranges::transform(batch, std::back_inserter(paths), to_path);
+        const auto results = digests<Hash>(paths, pool, options);
+
+        auto output = std::string{};
+        for(auto i = 0uz; i < batch.size(); ++i)
+        {
+            if (not results[i])
+            {
+                std::cout << output << std::flush;
+                output.clear();
+                std::cerr << options.program << ": " << batch[i] << ": " << results[i].error().message() << '\n';
+                status = 1;
+                continue;
+            }
+            auto name = std::string{};
+            if (escape(batch[i], name))
+                output.push_back('\\');
+            output += hexadecimal(*results[i]);
+            output += "  "sv;
+            output += name;
+            output.push_back('\n');
+        }
+        std::cout << output << std::flush;
+    }
+    return status;
+}
+
+std::string plural(std::size_t count, std::string_view one, std::string_view many)
+{
+    return std::to_string(count) + " "s + std::string{count == 1uz ? one : many};
+}
+
+// A whole checksum list, or the reason it could not be opened or read, e.g. EACCES or EISDIR
+std::expected<std::string, std::error_code> read_list(const std::string& name)
+{
+    const auto file = cryptic::file::mapped_file::open(to_path(name));
+    if (not file)
+        return std::unexpected{file.error()};
+
+    auto content = std::string{};
+    for(auto size = 0uz;;)
+    {
+        content.resize(size + cryptic::file::read_buffer_size);
+        const auto count = file->read(size, std::as_writable_bytes(std::span{content}).subspan(size));
+        if (not count)
+            return std::unexpected{count.error()};
+        size += *count;
+        if (*count < cryptic::file::read_buffer_size)
+        {
+            content.resize(size);
+            return content;
+        }
+    }
+}
+
+template<typename Hash>
+int check(const options& options, cryptic::file::thread_pool& pool)
+{
+    constexpr auto digest_size = std::tuple_size_v<typename Hash::buffer_type>;
+
+    auto status = 0;
+    for(const auto& list : options.files)
+    {
+        const auto content = read_list(list);
+        if (not content)
+        {
+            std::cerr << options.program << ": " << list << ": " << content.error().message() << '\n';
+            status = 1;
+            continue;
+        }
+        auto stream = std::istringstream{*content};
+
+        // "<hex>  <name>" or "<hex> *<name>", optionally escaped
+        auto expected = std::vector<std::string>{};
+        auto names = std::vector<std::string>{};
+        auto improper = 0uz;
+        for(auto line = std::string{}; std::getline(stream, line);)
+        {
+            auto view = std::string_view{line};
+            if (view.ends_with('\r'))
+                view.remove_suffix(1);
+            const auto escaped = view.starts_with('\\');
+            if (escaped)
+                view.remove_prefix(1);
+
+            const auto hex = view.substr(0, 2 * digest_size);
+            const auto valid = view.size() > 2 * digest_size + 1 and
+                               std::ranges::all_of(hex, [](char c){ return std::isxdigit(static_cast<unsigned char>(c)) != 0; }) and
+                               view[2 * digest_size] == ' ' and
+                               (view[2 * digest_size + 1] == ' ' or view[2 * digest_size + 1] == '*');
+            const auto name = valid and escaped ? unescape(view.substr(2 * digest_size + 2)) :
+                              valid ? std::optional{std::string{view.substr(2 * digest_size + 2)}} : std::nullopt;
+            if (not name or name->empty())
+            {
+                ++improper;
+                continue;
+            }
+            auto lower = std::string{hex};
+            std::ranges::transform(lower, lower.begin(), [](char c){ return static_cast<char>(std::tolower(static_cast<unsigned char>(c))); });
+            expected.push_back(std::move(lower));
+            names.push_back(*name);
+        }
+
+        if (names.empty())
+        {
+            std::cerr << options.program << ": " << list << ": no properly formatted checksum lines found\n";
+            status = 1;
+            continue;
+        }
+
+        auto paths = std::vector<std::filesystem::path>{};
+        std::ranges::transform(names, std::back_inserter(paths), to_path);
+        const auto results = digests<Hash>(paths, pool, options);
+
+        auto unreadable = 0uz, mismatched = 0uz;
+        for(auto i = 0uz; i < names.size(); ++i)
+        {
+            if (not results[i])
+            {
+                std::cout << std::flush;
+                std::cerr << options.program << ": " << names[i] << ": " << results[i].error().message() << '\n';
+                std::cout << status_name(names[i]) << ": FAILED open or read\n";
+                ++unreadable;
+            }
+            else if (hexadecimal(*results[i]) != expected[i])
+            {
+                std::cout << status_name(names[i]) << ": FAILED\n";
+                ++mismatched;
+            }
+            else
+            {
+                std::cout << status_name(names[i]) << ": OK\n";
+            }
+        }
+        std::cout << std::flush;
+
+        if (improper > 0uz)
+            std::cerr << options.program << ": WARNING: " << plural(improper, "line is improperly formatted"sv, "lines are improperly formatted"sv) << '\n';
+        if (unreadable > 0uz)
+            std::cerr << options.program << ": WARNING: " << plural(unreadable, "listed file could not be read"sv, "listed files could not be read"sv) << '\n';
+        if (mismatched > 0uz)
+            std::cerr << options.program << ": WARNING: " << plural(mismatched, "computed checksum did NOT match"sv, "computed checksums did NOT match"sv) << '\n';
+        if (unreadable > 0uz or mismatched > 0uz)
+            status = 1;
+    }
+    return status;
+}
+
+template<typename Hash>
+int run(const options& options)
+{
+    auto pool = cryptic::file::thread_pool{options.jobs};
+    return options.check ? check<Hash>(options, pool) : sum<Hash>(options, pool);
+}
+
+std::optional<std::size_t> to_number(std::string_view text)
+{
+    auto value = 0uz;
+    const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+    if (error != std::errc{} or end != text.data() + text.size() or value == 0uz)
+        return std::nullopt;
+    return value;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const auto arguments = std::vector<std::string_view>(argv, argv + argc);
+    auto options = ::options{};
+
+    // sha1sum, sha256sum, ... when installed under one of those names
+    options.program = std::filesystem::path{arguments.front()}.filename().string();
+    if (options.program.ends_with("sum"sv) and options.program.starts_with("sha"sv))
+        options.algorithm = options.program.substr(0, options.program.size() - 3);
+
+    auto operands = false;
+    for(auto i = 1uz; i < arguments.size(); ++i)
+    {
+        const auto argument = arguments[i];
+        const auto value = [&](std::string_view option) -> std::optional<std::string_view> {
+            if (argument.starts_with(option) and argument.size() > option.size() and argument[option.size()] == '=')
+                return argument.substr(option.size() + 1);
+            if (argument == option and i + 1 < arguments.size())
+                return arguments[++i];
+            return std::nullopt;
+        };
+
+        if (operands or argument == "-"sv or not argument.starts_with('-'))
+        {
+            options.files.emplace_back(argument);
+        }
+        else if (argument == "--"sv)
+        {
+            operands = true;
+        }
+        else if (argument == "--help"sv)
+        {
+            usage(options);
+            return 0;
+        }
+        else if (argument == "-c"sv or argument == "--check"sv)
+        {
+            options.check = true;
+        }
+        else if (argument == "--tree"sv)
+        {
+            options.tree = cryptic::file::tree_chunk_size;
+        }
+        else if (argument.starts_with("--tree="sv))
+        {
+            const auto size = to_number(argument.substr(7));
+            if (not size)
+            {
+                std::cerr << options.program << ": invalid leaf size: " << argument.substr(7) << '\n';
+                return 1;
+            }
+            options.tree = *size;
+        }
+        else if (const auto name = argument.starts_with("--"sv) ? value("--algorithm"sv) : value("-a"sv))
+        {
+            options.algorithm = *name;
+        }
+        else if (const auto jobs = argument.starts_with("--"sv) ? value("--jobs"sv) : value("-j"sv))
+        {
+            const auto count = to_number(*jobs);
+            if (not count)
+            {
+                std::cerr << options.program << ": invalid number of jobs: " << *jobs << '\n';
+                return 1;
+            }
+            options.jobs = static_cast<unsigned>(*count);
+        }
+        else
+        {
+            std::cerr << options.program << ": unrecognized option '" << argument << "'\n"
+                      << "Try '" << options.program << " --help' for more information.\n";
+            return 1;
+        }
+    }
+
+    if (options.files.empty())
+        options.files.emplace_back("-"s);
+
+    if (options.algorithm == "sha1"sv) return run<cryptic::sha1>(options);
+    if (options.algorithm == "sha224"sv) return run<cryptic::sha224>(options);
+    if (options.algorithm == "sha256"sv) return run<cryptic::sha256>(options);
+    if (options.algorithm == "sha384"sv) return run<cryptic::sha384>(options);
+    if (options.algorithm == "sha512"sv) return run<cryptic::sha512>(options);
+    if (options.algorithm == "sha512-256"sv) return run<cryptic::sha512_256>(options);
+
+    std::cerr << options.program << ": unknown algorithm: " << options.algorithm << '\n';
+    return 1;
+}
@@ -5,6 +5,7 @@ import std;
 import cryptic;
 
 using namespace std::string_literals;
+using namespace std::string_view_literals;
 
 int main()
 {
@@ -22,6 +23,10 @@ int main()
     auto const test3 = "omQGMC65WBEzzZAX7H8l+g==258EAFA5-E914-47DA-95CA-C5AB0DC85B11"s;
     std::cout << cryptic::sha1::base64(test3) << std::endl;
 
+    // The same handshake value without concatenating or allocating
+    auto const accept = cryptic::websocket::accept_key("omQGMC65WBEzzZAX7H8l+g=="sv);
+    std::cout << std::string_view{accept.data(), accept.size()} << std::endl;
+
     auto const test4 = "omQGMC65WBEzzZAX7H8l+g==258EAFA5-E914-47DA-95CA-C5AB0DC85B11_XXXXXX"s;
     std::cout << cryptic::sha1::base64(test4) << std::endl;
 
@@ -0,0 +1,714 @@
+// SPDX-License-Identifier: MIT
+// See the LICENSE file in the project root for full license text.
+
+// throughput - release benchmark for cryptic: a message size sweep of every hash, one-shot and
+// streaming, hash_batch(), base64 and multi-thread scaling. Reports ns/op, GB/s and cycles/byte
+// as a table, CSV or JSON and compares against a stored baseline to flag regressions.
+// OpenSSL's EVP API is measured alongside when its headers are available and --no-openssl is not given.
+
+#if __has_include(<openssl/evp.h>)
+#include <openssl/evp.h>
+#define CRYPTIC_BENCHMARK_OPENSSL 1
+#endif
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+import cryptic;
+import std;
+
+using namespace std::literals;
+
+namespace {
+
+struct options
+{
+    std::string format = "table"s; // table, csv or json
+    std::string filter = {};
+    std::string baseline = {};
+    double threshold = 0.05; // relative ns/op increase counted as a regression
+    std::size_t max_size = 16uz << 20;
+    std::chrono::nanoseconds min_time = 50ms;
+    unsigned repetitions = 3;
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    double ghz = 0.0; // cycles per ns, zero for calibrate or unknown
+    bool openssl = true;
+};
+
+struct result
+{
+    std::string name;                  // group/case/bytes, the key for baselines
+    std::size_t size = 0uz;            // bytes processed per operation
+    std::size_t iterations = 0uz;      // operations per repetition
+    double ns_per_op = 0.0;            // median over the repetitions
+    double openssl_ns_per_op = std::numeric_limits<double>::quiet_NaN();
+    double baseline_ns_per_op = std::numeric_limits<double>::quiet_NaN();
+};
+
+constexpr auto nan = std::numeric_limits<double>::quiet_NaN();
+
+// Every size boundary a hash cares about: empty, one byte, the padding edge of a 64-byte
+// chunk, the chunks themselves and then powers of four up to 16 MiB
+constexpr auto sizes = std::array{0uz, 1uz, 16uz, 55uz, 56uz, 64uz, 128uz, 256uz, 1uz << 10, 4uz << 10, 16uz << 10,
+                                  64uz << 10, 256uz << 10, 1uz << 20, 4uz << 20, 16uz << 20};
+
+// Streaming feeds messages in packet-sized pieces that straddle chunk boundaries
+constexpr auto stream_piece = 1000uz;
+
+// hash_batch() targets many short messages
+constexpr auto batch_messages = 64uz;
+constexpr auto batch_max_size = 16uz << 10;
+
+// Tells the optimizer the value is observed, so the work producing it can be neither dropped
+// nor hoisted out of the timing loop; the memory clobber also forces inputs to be reread
+inline void sink(const auto& value) noexcept
+{
+    asm volatile("" : : "r"(&value) : "memory");
+}
+
+// Reference cycles per nanosecond. On x86-64 the invariant TSC is calibrated against
+// steady_clock, so cycles/byte reads as TSC cycles; elsewhere only --ghz provides it.
+double calibrate_ghz()
+{
+#if defined(__x86_64__)
+    const auto t1 = std::chrono::steady_clock::now();
+    const auto c1 = __rdtsc();
+    while (std::chrono::steady_clock::now() - t1 < 100ms);
+    const auto c2 = __rdtsc();
+    const auto t2 = std::chrono::steady_clock::now();
+    return static_cast<double>(c2 - c1) / static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count());
+#else
+    return 0.0;
+#endif
+}
+
+std::string size_name(std::size_t size)
+{
+    if (size >= (1uz << 20) and size % (1uz << 20) == 0uz)
+        return std::to_string(size >> 20) + "MiB"s;
+    if (size >= (1uz << 10) and size % (1uz << 10) == 0uz)
+        return std::to_string(size >> 10) + "KiB"s;
+    return std::to_string(size) + "B"s;
+}
+
+// Runs operation in repetitions of an iteration count that fills min_time and returns the
+// iteration count and the median ns/op; the first, untimed call warms caches and page tables
+template<typename Operation>
+std::pair<std::size_t, double> measure(Operation&& operation, const options& options)
+{
+    const auto time = [&](std::size_t iterations) {
+        const auto t1 = std::chrono::steady_clock::now();
+        for(auto i = iterations; i; --i)
+            operation();
+        const auto t2 = std::chrono::steady_clock::now();
+        return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count());
+    };
+
+    operation();
+
+    const auto target = static_cast<double>(options.min_time.count());
+    auto iterations = 1uz;
+    for(auto elapsed = time(iterations); elapsed < target and iterations < (1uz << 32);)
+    {
+        const auto estimate = elapsed > 0.0 ? 1.2 * target / (elapsed / static_cast<double>(iterations)) : 10.0 * static_cast<double>(iterations);
+        iterations = std::clamp(static_cast<std::size_t>(estimate), iterations + 1uz, 10uz * iterations);
+        elapsed = time(iterations);
+    }
+
+    auto samples = std::vector<double>{};
+    for(auto r = 0u; r < options.repetitions; ++r)
+        samples.push_back(time(iterations) / static_cast<double>(iterations));
+    std::ranges::sort(samples);
+    return {iterations, samples[samples.size() / 2uz]};
+}
+
+#if defined(CRYPTIC_BENCHMARK_OPENSSL)
+
+// An explicitly fetched digest and a reused context, the fastest way through EVP
+class openssl_digest
+{
+public:
+
+    explicit openssl_digest(const char* name) :
+        m_md{EVP_MD_fetch(nullptr, name, nullptr)},
+        m_context{EVP_MD_CTX_new()}
+    {}
+
+    openssl_digest(const openssl_digest&) = delete;
+
+    openssl_digest& operator = (const openssl_digest&) = delete;
+
+    ~openssl_digest()
+    {
+        EVP_MD_CTX_free(m_context);
+        EVP_MD_free(m_md);
+    }
+
+    explicit operator bool () const noexcept
+    {
+        return m_md != nullptr and m_context != nullptr;
+    }
+
+    void hash(std::span<const std::byte> message, std::size_t piece = 0uz) noexcept
+    {
+        EVP_DigestInit_ex2(m_context, m_md, nullptr);
+        if (piece == 0uz)
+            piece = std::max(message.size(), 1uz);
+        for(auto offset = 0uz; offset < message.size(); offset += piece)
+            EVP_DigestUpdate(m_context, message.data() + offset, std::min(piece, message.size() - offset));
+        auto length = 0u;
+        EVP_DigestFinal_ex(m_context, m_digest.data(), &length);
+        sink(m_digest);
+    }
+
+    const std::array<unsigned char, EVP_MAX_MD_SIZE>& digest() const noexcept
+    {
+        return m_digest;
+    }
+
+private:
+
+    EVP_MD* m_md;
+
+    EVP_MD_CTX* m_context;
+
+    std::array<unsigned char, EVP_MAX_MD_SIZE> m_digest = {};
+};
+
+#endif
+
+class suite
+{
+public:
+
+    explicit suite(const options& options) :
+        m_options{options},
+        m_ghz{options.ghz > 0.0 ? options.ghz : calibrate_ghz()},
+        m_data(options.max_size)
+    {
+        // xorshift64: incompressible and identical on every run
+        auto state = 0x9E3779B97F4A7C15ull;
+        for(auto& byte : m_data)
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            byte = static_cast<std::byte>(state);
+        }
+        if (not options.baseline.empty())
+            load_baseline();
+    }
+
+    int run()
+    {
+        begin();
+
+        hashes<cryptic::sha1>("sha1"sv, "SHA1");
+        hashes<cryptic::sha224>("sha224"sv, "SHA224");
+        hashes<cryptic::sha256>("sha256"sv, "SHA256");
+        hashes<cryptic::sha384>("sha384"sv, "SHA384");
+        hashes<cryptic::sha512>("sha512"sv, "SHA512");
+        hashes<cryptic::sha512_256>("sha512_256"sv, "SHA512-256");
+
+        batch<cryptic::sha1>("sha1"sv, "SHA1");
+        batch<cryptic::sha256>("sha256"sv, "SHA256");
+
+        base64();
+
+        websocket();
+
+        threads();
+
+        end();
+        return m_regressions > 0uz ? 1 : 0;
+    }
+
+private:
+
+    bool selected(const std::string& name) const
+    {
+        return m_options.filter.empty() or name.find(m_options.filter) != std::string::npos;
+    }
+
+    std::span<const std::byte> message(std::size_t size) const
+    {
+        return std::span{m_data}.first(size);
+    }
+
+    auto size_range(std::size_t limit = std::numeric_limits<std::size_t>::max()) const
+    {
+        return sizes | std::views::filter([this, limit](std::size_t size){ return size <= std::min(limit, m_options.max_size); });
+    }
+
+    template<typename Hash>
+    void hashes(std::string_view name, [[maybe_unused]] const char* openssl_name)
+    {
+#if defined(CRYPTIC_BENCHMARK_OPENSSL)
+        auto openssl = openssl_digest{openssl_name};
+        const auto compare = m_options.openssl and static_cast<bool>(openssl);
+#endif
+        for(const auto size : size_range())
+        {
+            const auto bytes = message(size);
+
+            auto oneshot = result{"oneshot/"s + std::string{name} + "/"s + size_name(size), size};
+            if (selected(oneshot.name))
+            {
+                std::tie(oneshot.iterations, oneshot.ns_per_op) = measure([&]{ sink(Hash::digest(bytes)); }, m_options);
+#if defined(CRYPTIC_BENCHMARK_OPENSSL)
+                if (compare)
+                    oneshot.openssl_ns_per_op = measure([&]{ openssl.hash(bytes); }, m_options).second;
+#endif
+                report(std::move(oneshot));
+            }
+
+            auto streaming = result{"streaming/"s + std::string{name} + "/"s + size_name(size), size};
+            if (selected(streaming.name))
+            {
+                std::tie(streaming.iterations, streaming.ns_per_op) = measure([&]{
+                    auto hash = Hash{};
+                    for(auto offset = 0uz; offset < size; offset += stream_piece)
+                        hash.update(bytes.subspan(offset, std::min(stream_piece, size - offset)));
+                    sink(hash.finalize());
+                }, m_options);
+#if defined(CRYPTIC_BENCHMARK_OPENSSL)
+                if (compare)
+                    streaming.openssl_ns_per_op = measure([&]{ openssl.hash(bytes, stream_piece); }, m_options).second;
+#endif
+                report(std::move(streaming));
+            }
+        }
+    }
+
+    // Per message cost of batch_messages equally sized messages, through the lanes and serially
+    template<typename Hash>
+    void batch(std::string_view name, [[maybe_unused]] const char* openssl_name)
+    {
+#if defined(CRYPTIC_BENCHMARK_OPENSSL)
+        auto openssl = openssl_digest{openssl_name};
+        const auto compare = m_options.openssl and static_cast<bool>(openssl);
+#endif
+        auto digests = std::vector<typename Hash::buffer_type>(batch_messages);
+        for(const auto size : size_range(batch_max_size))
+        {
+            auto entry = result{"batch/"s + std::string{name} + "/"s + size_name(size), size};
+            // The same messages one at a time, the baseline the lanes have to beat
+            auto serial = result{entry.name + "/serial"s, size};
+            if (not (selected(entry.name) or selected(serial.name)) or size * batch_messages > m_data.size())
+                continue;
+
+            auto messages = std::vector<std::span<const std::byte>>{};
+            for(auto i = 0uz; i < batch_messages; ++i)
+                messages.push_back(std::span{m_data}.subspan(i * size, size));
+
+            if (selected(entry.name))
+            {
+                const auto [iterations, ns] = measure([&]{ Hash::hash_batch(messages, digests); sink(digests); }, m_options);
+                entry.iterations = iterations;
+                entry.ns_per_op = ns / static_cast<double>(batch_messages);
+#if defined(CRYPTIC_BENCHMARK_OPENSSL)
+                if (compare)
+                    entry.openssl_ns_per_op = measure([&]{
+                        for(const auto& m : messages)
+                            openssl.hash(m);
+                    }, m_options).second / static_cast<double>(batch_messages);
+#endif
+                report(std::move(entry));
+            }
+
+            if (selected(serial.name))
+            {
+                std::tie(serial.iterations, serial.ns_per_op) = measure([&]{
+                    for(auto i = 0uz; i < batch_messages; ++i)
+                        Hash{messages[i]}.encode(digests[i]);
+                    sink(digests);
+                }, m_options);
+                serial.ns_per_op /= static_cast<double>(batch_messages);
+                report(std::move(serial));
+            }
+        }
+    }
+
+    void base64()
+    {
+        auto encoded = std::vector<char>(cryptic::base64::encoded_size(m_data.size()) + 1uz);
+        auto decoded = std::vector<std::byte>(m_data.size() + 3uz);
+        for(const auto size : size_range())
+        {
+            const auto bytes = message(size);
+            const auto length = cryptic::base64::encode(bytes, std::span{encoded});
+            const auto text = std::string_view{encoded.data(), length};
+
+            auto encode = result{"base64/encode/"s + size_name(size), size};
+            if (selected(encode.name))
+            {
+                std::tie(encode.iterations, encode.ns_per_op) = measure([&]{
+                    sink(cryptic::base64::encode(bytes, std::span{encoded}));
+                }, m_options);
+#if defined(CRYPTIC_BENCHMARK_OPENSSL)
+                if (m_options.openssl)
+                    encode.openssl_ns_per_op = measure([&]{
+                        sink(EVP_EncodeBlock(reinterpret_cast<unsigned char*>(encoded.data()),
+                                             reinterpret_cast<const unsigned char*>(bytes.data()), static_cast<int>(size)));
+                    }, m_options).second;
+#endif
+                report(std::move(encode));
+            }
+
+            auto decode = result{"base64/decode/"s + size_name(size), size};
+            if (selected(decode.name))
+            {
+                std::tie(decode.iterations, decode.ns_per_op) = measure([&]{
+                    sink(cryptic::base64::decode(text, std::span{decoded}));
+                }, m_options);
+#if defined(CRYPTIC_BENCHMARK_OPENSSL)
+                if (m_options.openssl)
+                    decode.openssl_ns_per_op = measure([&]{
+                        sink(EVP_DecodeBlock(reinterpret_cast<unsigned char*>(decoded.data()),
+                                             reinterpret_cast<const unsigned char*>(text.data()), static_cast<int>(text.size())));
+                    }, m_options).second;
+#endif
+                report(std::move(decode));
+            }
+        }
+    }
+
+    // Sec-WebSocket-Accept values for random 24-character keys, one at a time and as a burst;
+    // OpenSSL concatenates key and GUID on the stack, hashes and encodes
+    void websocket()
+    {
+        constexpr auto burst = 1024uz;
+        auto keys = std::vector<std::string>{};
+        auto generator = std::mt19937_64{6455};
+        for(auto i = 0uz; i < burst; ++i)
+        {
+            auto nonce = std::array<std::byte, 16>{};
+            for(auto& byte : nonce)
+                byte = static_cast<std::byte>(generator());
+            keys.push_back(cryptic::base64::encode(nonce));
+        }
+        const auto views = std::vector<std::string_view>(keys.begin(), keys.end());
+        auto accepts = std::vector<cryptic::websocket::accept_type>(burst);
+        const auto size = cryptic::websocket::key_size + cryptic::websocket::guid.size();
+
+#if defined(CRYPTIC_BENCHMARK_OPENSSL)
+        auto openssl = openssl_digest{"SHA1"};
+        const auto openssl_accept = [&](std::string_view key, char* accept) {
+            auto message = std::array<char, 128>{};
+            const auto end = std::ranges::copy(cryptic::websocket::guid, std::ranges::copy(key, message.begin()).out).out;
+            openssl.hash(std::as_bytes(std::span{message.begin(), end}));
+            sink(EVP_EncodeBlock(reinterpret_cast<unsigned char*>(accept), openssl.digest().data(), 20));
+        };
+        const auto compare = m_options.openssl and static_cast<bool>(openssl) and
+                             (selected("websocket/accept_key"s) or selected("websocket/accept_keys"s));
+        const auto openssl_ns = compare ? measure([&]{
+            for(auto i = 0uz; i < burst; ++i)
+                openssl_accept(views[i], accepts[i].data());
+        }, m_options).second / static_cast<double>(burst) : nan;
+#else
+        const auto openssl_ns = nan;
+#endif
+
+        auto single = result{"websocket/accept_key"s, size};
+        if (selected(single.name))
+        {
+            std::tie(single.iterations, single.ns_per_op) = measure([&]{
+                for(auto i = 0uz; i < burst; ++i)
+                    accepts[i] = cryptic::websocket::accept_key(views[i]);
+                sink(accepts);
+            }, m_options);
+            single.ns_per_op /= static_cast<double>(burst);
+            single.openssl_ns_per_op = openssl_ns;
+            report(std::move(single));
+        }
+
+        auto batch = result{"websocket/accept_keys"s, size};
+        if (selected(batch.name))
+        {
+            std::tie(batch.iterations, batch.ns_per_op) = measure([&]{
+                cryptic::websocket::accept_keys(views, accepts);
+                sink(accepts);
+            }, m_options);
+            batch.ns_per_op /= static_cast<double>(burst);
+            batch.openssl_ns_per_op = openssl_ns;
+            report(std::move(batch));
+        }
+    }
+
+    // Scaling from one thread up to --threads: one large input as a tree of 1 MiB leaves,
+    // and many independent 64 KiB messages hashed side by side
+    void threads()
+    {
+        constexpr auto piece = 64uz << 10;
+        const auto bytes = message(m_data.size());
+        auto pieces = std::vector<cryptic::sha256::buffer_type>(bytes.size() / piece);
+
+        auto counts = std::vector<unsigned>{};
+        for(auto count = 1u; count < m_options.threads; count *= 2u)
+            counts.push_back(count);
+        counts.push_back(m_options.threads);
+
+        for(const auto count : counts)
+        {
+            auto pool = cryptic::file::thread_pool{count};
+
+            auto tree = result{"threads/sha256-tree/"s + std::to_string(count), bytes.size()};
+            if (selected(tree.name) and bytes.size() > 0uz)
+            {
+                std::tie(tree.iterations, tree.ns_per_op) = measure([&]{ sink(cryptic::file::tree_hash<cryptic::sha256>(bytes, pool)); }, m_options);
+                report(std::move(tree));
+            }
+
+            auto independent = result{"threads/sha256-messages/"s + std::to_string(count), pieces.size() * piece};
+            if (selected(independent.name) and not pieces.empty())
+            {
+                std::tie(independent.iterations, independent.ns_per_op) = measure([&]{
+                    pool.for_each(pieces.size(), [&](std::size_t i){ pieces[i] = cryptic::sha256::digest(bytes.subspan(i * piece, piece)).bytes; });
+                    sink(pieces);
+                }, m_options);
+                report(std::move(independent));
+            }
+        }
+    }
+
+    // A baseline is an earlier CSV or JSON report of this program; rows are matched by name
+    void load_baseline()
+    {
+        auto stream = std::ifstream{m_options.baseline};
+        if (not stream)
+        {
+            std::clog << "throughput: cannot read baseline " << m_options.baseline << '\n';
+            return;
+        }
+
+        auto name_column = std::string::npos, ns_column = std::string::npos;
+        for(auto line = std::string{}; std::getline(stream, line);)
+        {
+            if (line.find("\"name\":\""sv) != std::string::npos)
+            {
+                const auto name = line.find("\"name\":\""sv) + 8uz;
+                const auto ns = line.find("\"ns_per_op\":"sv);
+                if (ns != std::string::npos)
+                    m_baseline[line.substr(name, line.find('"', name) - name)] = std::strtod(line.c_str() + ns + 12uz, nullptr);
+                continue;
+            }
+
+            auto fields = std::vector<std::string>{};
+            for(auto field : std::views::split(line, ','))
+                fields.emplace_back(field.begin(), field.end());
+            if (name_column == std::string::npos)
+            {
+                const auto column = [&](std::string_view header) {
+                    const auto found = std::ranges::find(fields, header);
+                    return found == fields.end() ? std::string::npos : static_cast<std::size_t>(found - fields.begin());
+                };
+                name_column = column("name"sv);
+                ns_column = column("ns_per_op"sv);
+                continue;
+            }
+            if (ns_column != std::string::npos and std::max(name_column, ns_column) < fields.size())
+                m_baseline[fields[name_column]] = std::strtod(fields[ns_column].c_str(), nullptr);
+        }
+
+        if (m_baseline.empty())
+            std::clog << "throughput: no results in baseline " << m_options.baseline << '\n';
+    }
+
+    double gb_per_s(double ns, std::size_t size) const
+    {
+        return ns > 0.0 ? static_cast<double>(size) / ns : nan;
+    }
+
+    double cycles_per_byte(double ns, std::size_t size) const
+    {
+        return m_ghz > 0.0 and size > 0uz ? ns * m_ghz / static_cast<double>(size) : nan;
+    }
+
+    static std::string number(double value, int precision = 3)
+    {
+        if (std::isnan(value))
+            return {};
+        auto stream = std::ostringstream{};
+        stream << std::fixed << std::setprecision(precision) << value;
+        return stream.str();
+    }
+
+    static std::string json_number(double value, int precision = 3)
+    {
+        return std::isnan(value) ? "null"s : number(value, precision);
+    }
+
+    std::string features() const
+    {
+        const auto& f = cryptic::cpu::features();
+        auto result = std::string{};
+        for(const auto& [enabled, name] : {std::pair{f.ssse3, "ssse3"sv}, {f.sha, "sha"sv}, {f.avx2, "avx2"sv}, {f.avx512, "avx512"sv}})
+            if (enabled)
+                result += (result.empty() ? ""s : " "s) + std::string{name};
+        return result.empty() ? "scalar"s : result;
+    }
+
+    void begin()
+    {
+        std::clog << "cryptic throughput: cpu features " << features() << ", " << m_options.threads << " thread(s), "
+                  << (m_ghz > 0.0 ? number(m_ghz, 2) + " GHz reference clock"s : "no cycle counter"s) << ", OpenSSL "
+#if defined(CRYPTIC_BENCHMARK_OPENSSL)
+                  << (m_options.openssl ? "on"sv : "off"sv)
+#else
+                  << "not available"sv
+#endif
+                  << '\n';
+
+        if (m_options.format == "csv"sv)
+        {
+            std::cout << "name,size,iterations,ns_per_op,gb_per_s,cycles_per_byte,openssl_ns_per_op,openssl_gb_per_s,baseline_ns_per_op,change\n";
+        }
+        else if (m_options.format == "json"sv)
+        {
+            std::cout << "{\n\"machine\":{\"features\":\"" << features() << "\",\"threads\":" << m_options.threads
+                      << ",\"ghz\":" << json_number(m_ghz > 0.0 ? m_ghz : nan, 3) << "},\n\"results\":[";
+        }
+        else
+        {
+            std::cout << std::left << std::setw(34) << "name" << std::right << std::setw(14) << "ns/op" << std::setw(10) << "GB/s"
+                      << std::setw(10) << "cyc/B" << std::setw(12) << "vs OpenSSL" << std::setw(10) << "vs base" << '\n';
+        }
+        std::cout << std::flush;
+    }
+
+    void report(result entry)
+    {
+        const auto base = m_baseline.find(entry.name);
+        if (base != m_baseline.end())
+            entry.baseline_ns_per_op = base->second;
+        const auto change = entry.ns_per_op / entry.baseline_ns_per_op - 1.0;
+        const auto regressed = not std::isnan(change) and change > m_options.threshold;
+        if (regressed)
+            m_flagged.push_back(entry.name + " "s + number(100.0 * change, 1) + "% slower"s);
+        m_regressions += regressed ? 1uz : 0uz;
+
+        const auto gb = gb_per_s(entry.ns_per_op, entry.size);
+        const auto openssl_gb = gb_per_s(entry.openssl_ns_per_op, entry.size);
+
+        if (m_options.format == "csv"sv)
+        {
+            std::cout << entry.name << ',' << entry.size << ',' << entry.iterations << ',' << number(entry.ns_per_op) << ','
+                      << number(gb, 4) << ',' << number(cycles_per_byte(entry.ns_per_op, entry.size)) << ','
+                      << number(entry.openssl_ns_per_op) << ',' << number(openssl_gb, 4) << ','
+                      << number(entry.baseline_ns_per_op) << ',' << number(change, 4) << '\n';
+        }
+        else if (m_options.format == "json"sv)
+        {
+            std::cout << (m_first ? "\n"sv : ",\n"sv)
+                      << "{\"name\":\"" << entry.name << "\",\"size\":" << entry.size << ",\"iterations\":" << entry.iterations
+                      << ",\"ns_per_op\":" << json_number(entry.ns_per_op) << ",\"gb_per_s\":" << json_number(gb, 4)
+                      << ",\"cycles_per_byte\":" << json_number(cycles_per_byte(entry.ns_per_op, entry.size))
+                      << ",\"openssl_ns_per_op\":" << json_number(entry.openssl_ns_per_op)
+                      << ",\"openssl_gb_per_s\":" << json_number(openssl_gb, 4)
+                      << ",\"baseline_ns_per_op\":" << json_number(entry.baseline_ns_per_op)
+                      << ",\"change\":" << json_number(change, 4) << ",\"regression\":" << (regressed ? "true"sv : "false"sv) << '}';
+        }
+        else
+        {
+            std::cout << std::left << std::setw(34) << entry.name << std::right << std::setw(14) << number(entry.ns_per_op, 1)
+                      << std::setw(10) << number(gb, 3) << std::setw(10) << number(cycles_per_byte(entry.ns_per_op, entry.size), 2)
+                      << std::setw(12) << (std::isnan(entry.openssl_ns_per_op) ? ""s : number(entry.openssl_ns_per_op / entry.ns_per_op, 2) + "x"s)
+                      << std::setw(10) << (std::isnan(change) ? ""s : (change >= 0.0 ? "+"s : ""s) + number(100.0 * change, 1) + "%"s)
+                      << (regressed ? " REGRESSION"sv : ""sv) << '\n';
+        }
+        std::cout << std::flush;
+        m_first = false;
+    }
+
+    void end()
+    {
+        if (m_options.format == "json"sv)
+            std::cout << "\n]\n}\n" << std::flush;
+
+        if (m_options.baseline.empty())
+            return;
+        for(const auto& flagged : m_flagged)
+            std::clog << "throughput: REGRESSION " << flagged << '\n';
+        std::clog << "throughput: " << m_regressions << " regression(s) past " << number(100.0 * m_options.threshold, 1)
+                  << "% against " << m_options.baseline << '\n';
+    }
+
+    const options& m_options;
+
+    double m_ghz;
+
+    std::vector<std::byte> m_data;
+
+    std::map<std::string, double> m_baseline;
+
+    std::vector<std::string> m_flagged;
+
+    std::size_t m_regressions = 0uz;
+
+    bool m_first = true;
+};
+
+void usage()
+{
+    std::cout << "Usage: throughput [OPTION]...\n"
+              << "Measure cryptic hashes, hash_batch(), base64 and thread scaling over message sizes from 0 B to 16 MiB.\n\n"
+              << "      --format=FORMAT     table (default), csv or json; progress and regressions go to stderr\n"
+              << "      --baseline=FILE     compare ns/op with an earlier csv or json report, exit 1 on regressions\n"
+              << "      --threshold=PCT     slowdown counted as a regression (default 5)\n"
+              << "      --filter=TEXT       only run benchmarks whose name contains TEXT, e.g. oneshot/sha256/\n"
+              << "      --max-size=BYTES    largest message size (default 16777216)\n"
+              << "      --min-time=MS       minimum duration of one repetition (default 50)\n"
+              << "      --repetitions=N     repetitions per benchmark, the median is reported (default 3)\n"
+              << "      --threads=N         largest thread count of the scaling runs (default: number of cores)\n"
+              << "      --ghz=GHZ           reference clock for cycles/byte instead of the calibrated TSC\n"
+              << "      --no-openssl        skip the OpenSSL comparison column (OpenSSL time / cryptic time)\n"
+              << "      --help              display this help and exit\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    auto options = ::options{};
+    for(const auto argument : std::vector<std::string_view>(argv + 1, argv + argc))
+    {
+        const auto value = [&](std::string_view option) -> std::optional<std::string> {
+            if (argument.starts_with(option) and argument.size() > option.size() and argument[option.size()] == '=')
+                return std::string{argument.substr(option.size() + 1uz)};
+            return std::nullopt;
+        };
+
+        if (argument == "--help"sv)
+        {
+            usage();
+            return 0;
+        }
+        else if (argument == "--no-openssl"sv)
+            options.openssl = false;
+        else if (const auto format = value("--format"sv); format and (*format == "table"sv or *format == "csv"sv or *format == "json"sv))
+            options.format = *format;
+        else if (const auto baseline = value("--baseline"sv))
+            options.baseline = *baseline;
+        else if (const auto threshold = value("--threshold"sv))
+            options.threshold = std::stod(*threshold) / 100.0;
+        else if (const auto filter = value("--filter"sv))
+            options.filter = *filter;
+        else if (const auto size = value("--max-size"sv))
+            options.max_size = std::stoull(*size);
+        else if (const auto time = value("--min-time"sv))
+            options.min_time = std::chrono::milliseconds{std::stoul(*time)};
+        else if (const auto repetitions = value("--repetitions"sv))
+            options.repetitions = std::max(1u, static_cast<unsigned>(std::stoul(*repetitions)));
+        else if (const auto threads = value("--threads"sv))
+            options.threads = std::max(1u, static_cast<unsigned>(std::stoul(*threads)));
+        else if (const auto ghz = value("--ghz"sv))
+            options.ghz = std::stod(*ghz);
+        else
+        {
+            std::cerr << "throughput: unrecognized option '" << argument << "'\n"
+                      << "Try 'throughput --help' for more information.\n";
+            return 2;
+        }
+    }
+
+    return suite{options}.run();
+}